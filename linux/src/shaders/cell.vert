@@ -5,6 +5,8 @@ uniform mat4 u_projection;
 uniform vec2 u_cell_size;
 uniform vec2 u_atlas_size;
 uniform vec2 u_padding;
+// Sub-cell smooth-scroll shift in pixels; the whole grid moves, instances don't
+uniform vec2 u_scroll_offset;
 
 // Per-instance attributes (matches CellData struct: 20 bytes)
 layout(location = 0) in uvec2 a_grid_pos;    // gridX, gridY
@@ -20,12 +22,14 @@ void main() {
     // Triangle strip: vertex 0-3 map to corners of the quad
     vec2 corner = vec2(gl_VertexID & 1, (gl_VertexID >> 1) & 1);
 
-    vec2 origin = u_padding + u_cell_size * vec2(a_grid_pos);
+    vec2 origin = u_padding + u_scroll_offset + u_cell_size * vec2(a_grid_pos);
     vec2 sz = vec2(a_glyph_size);
     vec2 off = vec2(a_offset);
     vec2 pos = origin + off + sz * corner;
 
     gl_Position = u_projection * vec4(pos, 0.0, 1.0);
-    v_tex_coord = (vec2(a_atlas_pos) + sz * corner) / u_atlas_size;
+    // Clamp to one atlas slot: solid quads wider than a cell (selection runs)
+    // keep sampling slot 0 instead of bleeding into the neighbouring glyphs.
+    v_tex_coord = (vec2(a_atlas_pos) + min(sz * corner, u_cell_size)) / u_atlas_size;
     v_color = a_color;
 }
@@ -202,13 +202,15 @@ final class CottySurface {
         cotty_terminal_selection_active(handle) != 0
     }
 
-    var selectedText: String? {
+    /// Raw UTF-8 bytes of the selection — a single copy out of Cot's buffer.
+    /// Call under the terminal lock, then decode after unlocking so large
+    /// selections don't hold the lock through String validation.
+    var selectedTextData: Data? {
         let ptr = cotty_terminal_selected_text(handle)
         let len = cotty_terminal_selected_text_len(handle)
         guard ptr != 0, len > 0 else { return nil }
         let bufPtr = UnsafeRawPointer(bitPattern: Int(ptr))!
-        let data = Data(bytes: bufPtr, count: Int(len))
-        return String(data: data, encoding: .utf8)
+        return Data(bytes: bufPtr, count: Int(len))
     }
 
     // MARK: - Terminal Cursor Shape
@@ -425,11 +425,12 @@ class TerminalView: NSView {
             return
         }
         // Copy-on-select: automatically copy selection to clipboard
-        if surface.selectionActive, let text = surface.selectedText {
+        let data = surface.selectionActive ? surface.selectedTextData : nil
+        surface.unlockTerminal()
+        if let data, let text = String(data: data, encoding: .utf8) {
             NSPasteboard.general.clearContents()
             NSPasteboard.general.setString(text, forType: .string)
         }
-        surface.unlockTerminal()
     }
 
     override func scrollWheel(with event: NSEvent) {
@@ -451,12 +452,12 @@ class TerminalView: NSView {
     @objc func copySelection(_ sender: Any?) {
         surface.lockTerminal()
         let hasSelection = surface.selectionActive
-        let text = hasSelection ? surface.selectedText : nil
+        let data = hasSelection ? surface.selectedTextData : nil
         if hasSelection {
             surface.selectionClear()
         }
         surface.unlockTerminal()
-        if let text {
+        if let data, let text = String(data: data, encoding: .utf8) {
             NSPasteboard.general.clearContents()
             NSPasteboard.general.setString(text, forType: .string)
             renderFrame()
@@ -5,6 +5,20 @@ import CoreText
 class Theme {
     static let shared = Theme()
 
+    /// Config groups that changed between two loads. Consumers only redo the
+    /// work for the groups they depend on (a color-only change keeps the atlas).
+    struct Changes: OptionSet {
+        let rawValue: Int
+        static let font    = Changes(rawValue: 1 << 0)
+        static let colors  = Changes(rawValue: 1 << 1)
+        static let cursor  = Changes(rawValue: 1 << 2)
+        static let padding = Changes(rawValue: 1 << 3)
+        static let all: Changes = [.font, .colors, .cursor, .padding]
+    }
+
+    /// Incremented by every load() that changed at least one group.
+    private(set) var generation: Int = 0
+
     // Font
     var fontName: String = "JetBrains Mono"
     var fontSize: CGFloat = 18
@@ -58,9 +72,17 @@ class Theme {
         return max(10, fontSize - 4)
     }
 
-    /// Load theme values from Cot config via FFI.
+    /// Load theme values from Cot config via FFI and report which groups changed.
     /// Must be called after cotty_app_new().
-    func load() {
+    @discardableResult
+    func load() -> Changes {
+        let oldFont = (fontName, fontSize, uiFontName, uiFontSize, inspectorFontSize)
+        let oldColors = [bgR, bgG, bgB, bgOpacity,
+                         Double(fgR), Double(fgG), Double(fgB),
+                         Double(selR), Double(selG), Double(selB)]
+        let oldCursor = (cursorR, cursorG, cursorB, cursorStyleTerminal, cursorStyleEditor)
+        let oldPadding = paddingPoints
+
         // Font name from Cot string pointer + length
         let namePtr = cotty_config_font_name()
         let nameLen = cotty_config_font_name_len()
@@ -120,6 +142,16 @@ class Theme {
         cursorStyleTerminal = Int(cotty_config_cursor_style_terminal())
         cursorStyleEditor = Int(cotty_config_cursor_style_editor())
         inspectorFontSize = CGFloat(cotty_config_inspector_font_size())
+
+        var changes: Changes = []
+        if oldFont != (fontName, fontSize, uiFontName, uiFontSize, inspectorFontSize) { changes.insert(.font) }
+        if oldColors != [bgR, bgG, bgB, bgOpacity,
+                         Double(fgR), Double(fgG), Double(fgB),
+                         Double(selR), Double(selG), Double(selB)] { changes.insert(.colors) }
+        if oldCursor != (cursorR, cursorG, cursorB, cursorStyleTerminal, cursorStyleEditor) { changes.insert(.cursor) }
+        if oldPadding != paddingPoints { changes.insert(.padding) }
+        if !changes.isEmpty { generation += 1 }
+        return changes
     }
 
     /// Set font size via FFI and update local value.
@@ -129,8 +161,9 @@ class Theme {
     }
 
     /// Reload config from disk and refresh all theme values.
-    func reload() {
+    @discardableResult
+    func reload() -> Changes {
         cotty_config_reload()
-        load()
+        return load()
     }
 }
@@ -893,13 +893,15 @@ class WorkspaceWindowController: NSWindowController, NSWindowDelegate, NSSplitVi
         addEditorTab(fileURL: url)
     }
 
-    /// Refresh Theme.shared from already-updated FFI config (no disk reload) and rebuild views.
+    /// Refresh Theme.shared from already-updated FFI config (no disk reload) and redraw views.
     func applyThemeChange() {
-        Theme.shared.load()
+        // Always redraw: the libcotty palette and split opacity aren't tracked
+        // by Theme.Changes, so an empty change set can still be a visible change.
+        let changes = Theme.shared.load()
         window?.backgroundColor = Theme.shared.background
         for (_, view) in viewsBySurface {
             if let tv = view as? TerminalView {
-                tv.renderer.rebuildAtlas()
+                if changes.contains(.font) { tv.renderer.rebuildAtlas() }
                 tv.setFrameSize(tv.frame.size)
             }
         }
@@ -935,11 +937,10 @@ class WorkspaceWindowController: NSWindowController, NSWindowDelegate, NSSplitVi
 
     @objc func resetFontSize(_ sender: Any?) {
         // Reload config to get the default font size, then apply it
-        Theme.shared.reload()
-        // rebuildAtlas is needed since reload changed the theme
+        let changes = Theme.shared.reload()
         for (_, view) in viewsBySurface {
             if let tv = view as? TerminalView {
-                tv.renderer.rebuildAtlas()
+                if changes.contains(.font) { tv.renderer.rebuildAtlas() }
                 tv.setFrameSize(tv.frame.size)
             }
         }
@@ -1091,20 +1092,23 @@ class WorkspaceWindowController: NSWindowController, NSWindowDelegate, NSSplitVi
     // MARK: - Config Reload
 
     @objc func reloadConfig(_ sender: Any?) {
-        Theme.shared.reload()
+        let changes = Theme.shared.reload()
         window?.backgroundColor = Theme.shared.background
+        // Atlases only depend on the font group. Everything else, including
+        // palette changes Theme.Changes doesn't track, is a redraw.
+        let fontChanged = changes.contains(.font)
         for (_, view) in viewsBySurface {
             if let tv = view as? TerminalView {
-                tv.renderer.rebuildAtlas()
+                if fontChanged { tv.renderer.rebuildAtlas() }
                 tv.setFrameSize(tv.frame.size)
             } else if let ev = view as? EditorView {
-                ev.renderer.rebuildAtlas()
+                if fontChanged { ev.renderer.rebuildAtlas() }
                 ev.setFrameSize(ev.frame.size)
             }
         }
         // Rebuild inspector with new font size
         if inspectorVisible, let iv = inspectorView {
-            iv.renderer.rebuildAtlas()
+            if fontChanged { iv.renderer.rebuildAtlas() }
             iv.setFrameSize(iv.frame.size)
         }
     }
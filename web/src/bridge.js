@@ -0,0 +1,346 @@
+// Cotty Web — JS bridge for the wasm build of web/src/main.cot
+//
+// Provides every `extern fn` main.cot imports and drives its exports:
+// requestAnimationFrame → cotty_frame, keyboard → cotty_key_press /
+// cotty_key_down, window resize → cotty_resize.
+//
+// wasm i64 values cross the boundary as BigInt: imports convert their
+// arguments with Number(), exports are called with BigInt().
+//
+// Usage:
+//   import { startCotty } from './bridge.js'
+//   startCotty(document.querySelector('canvas'), 'cotty.wasm')
+//   // remote mode: grid deltas from a server-side terminal
+//   startCotty(canvas, 'cotty.wasm', { attach: 'ws://localhost:8080/term' })
+//   // WebGL2 instanced renderer (shaders from ./shaders/cell.{vert,frag})
+//   startCotty(canvas, 'cotty.wasm', { webgl: true })
+
+// Draw command opcodes — must match CMD_* in main.cot
+const CMD_RECT = 1
+const CMD_TEXT = 2
+
+const utf8 = new TextDecoder('utf-8')
+
+// Instance record — must match INSTANCE_STRIDE / pushInstance in main.cot
+const INSTANCE_STRIDE = 20
+const ATLAS_SIZE = 1024
+const FONT = '16px "JetBrains Mono", monospace'
+
+// ============================================================================
+// WebGL2 backend
+// ============================================================================
+
+function compileShader(gl, type, src) {
+  const sh = gl.createShader(type)
+  gl.shaderSource(sh, src)
+  gl.compileShader(sh)
+  if (!gl.getShaderParameter(sh, gl.COMPILE_STATUS)) {
+    throw new Error(`cotty: shader compile failed: ${gl.getShaderInfoLog(sh)}`)
+  }
+  return sh
+}
+
+async function createWebGL(canvas, cellW, cellH) {
+  const gl = canvas.getContext('webgl2', { premultipliedAlpha: true })
+  if (!gl) return null
+  const [vsrc, fsrc] = await Promise.all([
+    fetch(new URL('./shaders/cell.vert', import.meta.url)).then((r) => r.text()),
+    fetch(new URL('./shaders/cell.frag', import.meta.url)).then((r) => r.text()),
+  ])
+
+  const program = gl.createProgram()
+  gl.attachShader(program, compileShader(gl, gl.VERTEX_SHADER, vsrc))
+  gl.attachShader(program, compileShader(gl, gl.FRAGMENT_SHADER, fsrc))
+  gl.linkProgram(program)
+  if (!gl.getProgramParameter(program, gl.LINK_STATUS)) {
+    throw new Error(`cotty: program link failed: ${gl.getProgramInfoLog(program)}`)
+  }
+  const u = (name) => gl.getUniformLocation(program, name)
+  const uniforms = {
+    projection: u('u_projection'), cellSize: u('u_cell_size'), atlasSize: u('u_atlas_size'),
+    padding: u('u_padding'), scrollOffset: u('u_scroll_offset'), atlas: u('u_atlas'),
+  }
+
+  // Same attribute layout as renderer_create in linux/src/renderer.cot
+  const vao = gl.createVertexArray()
+  const vbo = gl.createBuffer()
+  gl.bindVertexArray(vao)
+  gl.bindBuffer(gl.ARRAY_BUFFER, vbo)
+  const iattr = (loc, type, offset) => {
+    gl.enableVertexAttribArray(loc)
+    gl.vertexAttribIPointer(loc, 2, type, INSTANCE_STRIDE, offset)
+    gl.vertexAttribDivisor(loc, 1)
+  }
+  iattr(0, gl.UNSIGNED_SHORT, 0)
+  iattr(1, gl.UNSIGNED_SHORT, 4)
+  iattr(2, gl.UNSIGNED_SHORT, 8)
+  iattr(3, gl.SHORT, 12)
+  gl.enableVertexAttribArray(4)
+  gl.vertexAttribPointer(4, 4, gl.UNSIGNED_BYTE, true, INSTANCE_STRIDE, 16)
+  gl.vertexAttribDivisor(4, 1)
+  gl.bindVertexArray(null)
+
+  // Single-channel atlas; glyphs are rasterized white-on-transparent into an
+  // OffscreenCanvas slot and their alpha copied into the R8 texture.
+  const atlas = gl.createTexture()
+  gl.bindTexture(gl.TEXTURE_2D, atlas)
+  gl.pixelStorei(gl.UNPACK_ALIGNMENT, 1)
+  gl.texImage2D(gl.TEXTURE_2D, 0, gl.R8, ATLAS_SIZE, ATLAS_SIZE, 0, gl.RED, gl.UNSIGNED_BYTE, null)
+  gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.NEAREST)
+  gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.NEAREST)
+  gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE)
+  gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE)
+
+  const raster = new OffscreenCanvas(cellW, cellH)
+  const rctx = raster.getContext('2d', { willReadFrequently: true })
+  const slotsPerRow = Math.floor(ATLAS_SIZE / cellW)
+  const maxSlots = slotsPerRow * Math.floor(ATLAS_SIZE / cellH)
+  let nextSlot = 0
+
+  const upload = (slot, alpha) => {
+    const x = (slot % slotsPerRow) * cellW
+    const y = Math.floor(slot / slotsPerRow) * cellH
+    gl.bindTexture(gl.TEXTURE_2D, atlas)
+    gl.texSubImage2D(gl.TEXTURE_2D, 0, x, y, cellW, cellH, gl.RED, gl.UNSIGNED_BYTE, alpha)
+    return x | (y << 16)
+  }
+
+  const rasterize = (cp) => {
+    rctx.clearRect(0, 0, cellW, cellH)
+    rctx.font = FONT
+    rctx.fillStyle = '#fff'
+    rctx.fillText(String.fromCodePoint(cp), 0, cellH - 4)
+    const rgba = rctx.getImageData(0, 0, cellW, cellH).data
+    const alpha = new Uint8Array(cellW * cellH)
+    for (let i = 0; i < alpha.length; i++) alpha[i] = rgba[i * 4 + 3]
+    return alpha
+  }
+
+  // Slot 0: solid white for backgrounds and the cursor. Slot 1: U+FFFD,
+  // handed out once the atlas is full so new glyphs never draw as slot 0.
+  upload(0, new Uint8Array(cellW * cellH).fill(255))
+  const replacement = upload(1, rasterize(0xFFFD))
+  nextSlot = 2
+
+  // Codepoint → packed atlas position. The wasm cache evicts, so the same
+  // codepoint can be asked for again; it must not take a second slot.
+  const slots = new Map()
+
+  return {
+    glyphSlot(cp) {
+      let pos = slots.get(cp)
+      if (pos === undefined) {
+        pos = nextSlot < maxSlots ? upload(nextSlot++, rasterize(cp)) : replacement
+        slots.set(cp, pos)
+      }
+      return pos
+    },
+    draw(instances, count) {
+      const w = canvas.width
+      const h = canvas.height
+      gl.viewport(0, 0, w, h)
+      gl.clearColor(12 / 255, 12 / 255, 12 / 255, 1)
+      gl.clear(gl.COLOR_BUFFER_BIT)
+      if (count === 0) return
+      gl.enable(gl.BLEND)
+      gl.blendFunc(gl.ONE, gl.ONE_MINUS_SRC_ALPHA)
+      gl.useProgram(program)
+      // Top-left-origin orthographic projection (cotty_gl_set_projection)
+      gl.uniformMatrix4fv(uniforms.projection, false, new Float32Array([
+        2 / w, 0, 0, 0,
+        0, -2 / h, 0, 0,
+        0, 0, 1, 0,
+        -1, 1, 0, 1,
+      ]))
+      gl.uniform2f(uniforms.cellSize, cellW, cellH)
+      gl.uniform2f(uniforms.atlasSize, ATLAS_SIZE, ATLAS_SIZE)
+      gl.uniform2f(uniforms.padding, 0, 0)
+      gl.uniform2f(uniforms.scrollOffset, 0, 0)
+      gl.activeTexture(gl.TEXTURE0)
+      gl.bindTexture(gl.TEXTURE_2D, atlas)
+      gl.uniform1i(uniforms.atlas, 0)
+      gl.bindVertexArray(vao)
+      gl.bindBuffer(gl.ARRAY_BUFFER, vbo)
+      gl.bufferData(gl.ARRAY_BUFFER, instances, gl.STREAM_DRAW)
+      gl.drawArraysInstanced(gl.TRIANGLE_STRIP, 0, 4, count)
+      gl.bindVertexArray(null)
+    },
+  }
+}
+
+export async function startCotty(canvas, wasmUrl = 'cotty.wasm', options = {}) {
+  // A canvas holds one kind of context: 2D unless WebGL2 was asked for
+  const ctx = options.webgl ? null : canvas.getContext('2d')
+  let webgl = null
+  let exports = null
+  let frameQueued = false
+
+  const bytes = (ptr, len) => new Uint8Array(exports.memory.buffer, Number(ptr), Number(len))
+  const str = (ptr, len) => utf8.decode(bytes(ptr, len))
+  const rgb = (r, g, b) => `rgb(${Number(r)},${Number(g)},${Number(b)})`
+  const packed = (c) => `rgb(${(c >> 16) & 255},${(c >> 8) & 255},${c & 255})`
+
+  const sockets = [null]  // handle 0 = no socket
+
+  // Natural advance of the current font, measured once per font change
+  let measuredFont = ''
+  let measuredAdvance = 0
+  const fontAdvance = () => {
+    if (ctx.font !== measuredFont) {
+      measuredFont = ctx.font
+      measuredAdvance = ctx.measureText('M').width
+    }
+    return measuredAdvance
+  }
+  let letterSpacing = '0px'
+  const setLetterSpacing = (v) => {
+    if (v !== letterSpacing) ctx.letterSpacing = letterSpacing = v
+  }
+  // A run can be drawn as one string only if the primary monospace font
+  // covers it and letterSpacing is supported; CJK and emoji fall back to
+  // fonts with other advances.
+  const gridAligned = (cps) => {
+    if (!('letterSpacing' in ctx)) return false
+    for (let k = 0; k < cps.length; k++) if (cps[k] >= 0x2E80n) return false
+    return true
+  }
+
+  const env = {
+    // Canvas rendering
+    canvas_set_font(size, namePtr, nameLen) {
+      ctx.font = `${Number(size)}px "${str(namePtr, nameLen)}", monospace`
+      ctx.textBaseline = 'alphabetic'
+    },
+    canvas_fill_rect(x, y, w, h, r, g, b) {
+      ctx.fillStyle = rgb(r, g, b)
+      ctx.fillRect(Number(x), Number(y), Number(w), Number(h))
+    },
+    canvas_fill_text(ptr, len, x, y, r, g, b) {
+      ctx.fillStyle = rgb(r, g, b)
+      ctx.fillText(str(ptr, len), Number(x), Number(y))
+    },
+    canvas_clear(r, g, b) {
+      ctx.fillStyle = rgb(r, g, b)
+      ctx.fillRect(0, 0, canvas.width, canvas.height)
+    },
+    canvas_get_width() { return BigInt(canvas.width) },
+    canvas_get_height() { return BigInt(canvas.height) },
+
+    // One call per frame: walk the i64 command words written by main.cot.
+    // A text run is one fillText; letterSpacing pads the font's own advance
+    // out to the cell advance so the run stays on the grid.
+    canvas_draw_batch(ptr, len) {
+      const words = new BigInt64Array(exports.memory.buffer, Number(ptr), Number(len))
+      let i = 0
+      while (i < words.length) {
+        const op = Number(words[i])
+        if (op === CMD_RECT) {
+          ctx.fillStyle = packed(Number(words[i + 5]))
+          ctx.fillRect(Number(words[i + 1]), Number(words[i + 2]), Number(words[i + 3]), Number(words[i + 4]))
+          i += 6
+        } else if (op === CMD_TEXT) {
+          const x = Number(words[i + 1])
+          const y = Number(words[i + 2])
+          const advance = Number(words[i + 3])
+          ctx.fillStyle = packed(Number(words[i + 4]))
+          const n = Number(words[i + 5])
+          const cps = words.subarray(i + 6, i + 6 + n)
+          if (gridAligned(cps)) {
+            setLetterSpacing(`${advance - fontAdvance()}px`)
+            ctx.fillText(String.fromCodePoint(...Array.from(cps, Number)), x, y)
+          } else {
+            // Fallback-font glyphs have their own widths; place them per cell
+            setLetterSpacing('0px')
+            for (let k = 0; k < n; k++) {
+              const cp = Number(cps[k])
+              if (cp > 32) ctx.fillText(String.fromCodePoint(cp), x + k * advance, y)
+            }
+          }
+          i += 6 + n
+        } else {
+          console.error(`cotty: unknown draw command ${op}`)
+          return
+        }
+      }
+    },
+
+    // WebGL2 — only reached after cotty_use_webgl; main.cot caches glyph
+    // slots, so webgl_glyph_slot runs on a miss there, not every cell
+    webgl_glyph_slot(cp) { return BigInt(webgl.glyphSlot(Number(cp))) },
+    webgl_draw(ptr, count) {
+      const n = Number(count)
+      webgl.draw(bytes(ptr, n * INSTANCE_STRIDE), n)
+    },
+
+    // Logging
+    js_log(ptr, len) { console.log(str(ptr, len)) },
+
+    // Timer
+    request_frame() {
+      if (frameQueued) return
+      frameQueued = true
+      requestAnimationFrame(() => {
+        frameQueued = false
+        exports.cotty_frame()
+      })
+    },
+
+    // WebSocket
+    ws_connect(urlPtr, urlLen) {
+      const ws = new WebSocket(str(urlPtr, urlLen))
+      ws.binaryType = 'arraybuffer'
+      // Copy each binary message into wasm's receive buffer and decode it
+      ws.onmessage = (e) => {
+        if (!(e.data instanceof ArrayBuffer)) return
+        const data = new Uint8Array(e.data)
+        const ptr = exports.cotty_ws_buffer(BigInt(data.length))
+        if (ptr !== 0n) bytes(ptr, data.length).set(data)
+        exports.cotty_ws_message(ptr, BigInt(data.length))
+      }
+      sockets.push(ws)
+      return BigInt(sockets.length - 1)
+    },
+    ws_send(handle, ptr, len) {
+      const ws = sockets[Number(handle)]
+      if (!ws || ws.readyState !== WebSocket.OPEN) return
+      ws.send(bytes(ptr, len).slice())
+    },
+  }
+
+  const { instance } = await WebAssembly.instantiateStreaming(fetch(wasmUrl), { env })
+  exports = instance.exports
+
+  // Input: printable characters go to cotty_key_press; everything else,
+  // and any Ctrl/Alt/Meta combination, to cotty_key_down with the keyCode.
+  window.addEventListener('keydown', (e) => {
+    if (!e.ctrlKey && !e.altKey && !e.metaKey && [...e.key].length === 1) {
+      exports.cotty_key_press(BigInt(e.key.codePointAt(0)))
+    } else {
+      // Modifier bits — must match KEY_MOD_* in main.cot
+      const mods = (e.ctrlKey ? 1 : 0) | (e.altKey ? 2 : 0) | (e.metaKey ? 4 : 0) | (e.shiftKey ? 8 : 0)
+      if (exports.cotty_key_down(BigInt(e.keyCode), BigInt(mods)) === 0n) return
+    }
+    e.preventDefault()
+  })
+
+  window.addEventListener('resize', () => {
+    exports.cotty_resize(BigInt(canvas.width), BigInt(canvas.height))
+  })
+
+  if (options.webgl) {
+    webgl = await createWebGL(canvas, Number(exports.cotty_cell_width()), Number(exports.cotty_cell_height()))
+    if (!webgl) throw new Error('cotty: WebGL2 is not available')
+    exports.cotty_use_webgl()
+  }
+
+  if (options.attach) {
+    // The receive buffer doubles as scratch space for the URL string
+    const url = new TextEncoder().encode(options.attach)
+    const ptr = exports.cotty_ws_buffer(BigInt(url.length))
+    bytes(ptr, url.length).set(url)
+    exports.cotty_attach(ptr, BigInt(url.length))
+  }
+
+  exports.cotty_frame()
+  return exports
+}
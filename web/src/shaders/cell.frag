@@ -0,0 +1,20 @@
+#version 300 es
+
+// GLSL ES 3.00 variant of linux/src/shaders/cell.frag. The atlas is a single
+// channel (R8) texture: the bridge copies glyph coverage out of the
+// OffscreenCanvas alpha channel when it uploads a slot.
+
+precision mediump float;
+
+uniform sampler2D u_atlas;
+
+in vec2 v_tex_coord;
+in vec4 v_color;
+
+out vec4 frag_color;
+
+void main() {
+    float a = texture(u_atlas, v_tex_coord).r;
+    // Premultiplied alpha output (matches Metal shader)
+    frag_color = vec4(v_color.rgb * a, v_color.a * a);
+}
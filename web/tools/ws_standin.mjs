@@ -0,0 +1,232 @@
+// Local stand-in for the remote terminal server behind cotty_attach.
+//
+// Speaks the delta protocol documented in web/src/main.cot over a minimal
+// RFC 6455 WebSocket (Node built-ins only, no packages) and checks the
+// client's side of it:
+//
+//   1. full-state frame        → expects 'A' with its seq
+//   2. deliberately truncated  → expects 'R' with its seq
+//   3. full-state resync       → expects 'A' with its seq
+//
+// After that it echoes 'K' input into the grid, one delta in flight at a
+// time, and logs the key bytes in hex so special-key encoding can be checked.
+//
+// Usage:
+//   node web/tools/ws_standin.mjs [port]       (default 8080)
+//   startCotty(canvas, 'cotty.wasm', { attach: 'ws://localhost:8080/term' })
+
+import { createServer } from 'node:http'
+import { createHash } from 'node:crypto'
+
+const PORT = Number(process.argv[2] ?? 8080)
+const ROWS = 24
+const COLS = 80
+const FG = [217, 217, 217]
+const BG = [12, 12, 12]
+const PROMPT = [252, 151, 31]
+const MODE_CURSOR_VISIBLE = 1
+
+// ============================================================================
+// Delta frames
+// ============================================================================
+
+// rows: [{ row, runs: [{ col, text, fg, bg }] }]
+function encodeFrame(seq, cursorRow, cursorCol, rows) {
+  let size = 12
+  for (const r of rows) {
+    size += 4
+    for (const run of r.runs) size += 10 + [...run.text].length * 4
+  }
+  const buf = Buffer.alloc(size)
+  buf.writeUInt32LE(seq, 0)
+  buf.writeUInt16LE(cursorRow, 4)
+  buf.writeUInt16LE(cursorCol, 6)
+  buf.writeUInt16LE(MODE_CURSOR_VISIBLE, 8)
+  buf.writeUInt16LE(rows.length, 10)
+  let p = 12
+  for (const r of rows) {
+    buf.writeUInt16LE(r.row, p)
+    buf.writeUInt16LE(r.runs.length, p + 2)
+    p += 4
+    for (const run of r.runs) {
+      const cps = [...run.text].map((c) => c.codePointAt(0))
+      buf.writeUInt16LE(run.col, p)
+      buf.writeUInt16LE(cps.length, p + 2)
+      buf.set([...run.fg, ...run.bg], p + 4)
+      p += 10
+      for (const cp of cps) {
+        buf.writeUInt32LE(cp, p)
+        p += 4
+      }
+    }
+  }
+  return buf
+}
+
+function fullState(seq, line) {
+  const rows = []
+  for (let row = 0; row < ROWS; row++) rows.push({ row, runs: [{ col: 0, text: ' '.repeat(COLS), fg: FG, bg: BG }] })
+  rows[0].runs.push({ col: 0, text: 'cotty ws stand-in', fg: FG, bg: BG })
+  rows[1].runs.push({ col: 0, text: '$ ', fg: PROMPT, bg: BG })
+  if (line) rows[1].runs.push({ col: 2, text: line, fg: FG, bg: BG })
+  return encodeFrame(seq, 1, 2 + [...line].length, rows)
+}
+
+function lineDelta(seq, line) {
+  const text = line.padEnd(COLS - 2, ' ')
+  return encodeFrame(seq, 1, 2 + [...line].length, [{ row: 1, runs: [{ col: 2, text, fg: FG, bg: BG }] }])
+}
+
+// ============================================================================
+// WebSocket framing (server side: unmasked out, masked in)
+// ============================================================================
+
+function wsFrame(opcode, payload) {
+  const len = payload.length
+  let header
+  if (len < 126) {
+    header = Buffer.from([0x80 | opcode, len])
+  } else if (len < 65536) {
+    header = Buffer.alloc(4)
+    header[0] = 0x80 | opcode
+    header[1] = 126
+    header.writeUInt16BE(len, 2)
+  } else {
+    header = Buffer.alloc(10)
+    header[0] = 0x80 | opcode
+    header[1] = 127
+    header.writeBigUInt64BE(BigInt(len), 2)
+  }
+  return Buffer.concat([header, payload])
+}
+
+// Returns [{ opcode, payload }] and the unconsumed tail
+function wsParse(buf) {
+  const out = []
+  let p = 0
+  while (buf.length - p >= 2) {
+    const opcode = buf[p] & 0x0F
+    const masked = (buf[p + 1] & 0x80) !== 0
+    let len = buf[p + 1] & 0x7F
+    let q = p + 2
+    if (len === 126) {
+      if (buf.length - q < 2) break
+      len = buf.readUInt16BE(q)
+      q += 2
+    } else if (len === 127) {
+      if (buf.length - q < 8) break
+      len = Number(buf.readBigUInt64BE(q))
+      q += 8
+    }
+    const maskLen = masked ? 4 : 0
+    if (buf.length - q < maskLen + len) break
+    const payload = Buffer.from(buf.subarray(q + maskLen, q + maskLen + len))
+    if (masked) for (let i = 0; i < len; i++) payload[i] ^= buf[q + (i & 3)]
+    out.push({ opcode, payload })
+    p = q + maskLen + len
+  }
+  return [out, buf.subarray(p)]
+}
+
+// ============================================================================
+// Session
+// ============================================================================
+
+function session(socket) {
+  let seq = 0
+  let inFlight = -1       // seq awaiting an ack, -1 if none
+  let line = ''
+  let lineSent = ''
+  let failed = 0
+  // Handshake checks, in order: [seq, expected ack kind]
+  const expect = []
+
+  const send = (frame) => socket.write(wsFrame(2, frame))
+  const check = (ok, what) => {
+    if (!ok) failed++
+    console.log(`${ok ? 'PASS' : 'FAIL'}  ${what}`)
+  }
+
+  const pump = () => {
+    if (inFlight >= 0 || line === lineSent || expect.length > 0) return
+    seq++
+    send(lineDelta(seq, line))
+    lineSent = line
+    inFlight = seq
+  }
+
+  const onAck = (kind, ackSeq) => {
+    if (expect.length > 0) {
+      const [wantSeq, wantKind] = expect.shift()
+      check(kind === wantKind && ackSeq === wantSeq,
+        `seq ${wantSeq}: expected '${wantKind}', got '${kind}' seq ${ackSeq}`)
+      if (wantKind === 'A' && expect.length === 2) {
+        // Step 2: header promises one row, body is cut off mid-run
+        seq++
+        const bad = Buffer.alloc(18)
+        bad.writeUInt32LE(seq, 0)
+        bad.writeUInt16LE(1, 10)
+        bad.writeUInt16LE(1, 14)
+        send(bad)
+      }
+      if (expect.length === 0) {
+        console.log(failed === 0 ? 'handshake OK — echoing input' : `handshake: ${failed} check(s) failed`)
+      }
+    }
+    if (kind === 'R' && expect.length === 1) {
+      // Step 3: full state answers the resync request
+      seq++
+      send(fullState(seq, line))
+      lineSent = line
+    }
+    if (ackSeq === inFlight) inFlight = -1
+    pump()
+  }
+
+  const onKey = (bytes) => {
+    console.log(`key   ${[...bytes].map((b) => b.toString(16).padStart(2, '0')).join(' ')}`)
+    const text = bytes.toString('utf8')
+    if (bytes[0] === 0x7F || bytes[0] === 0x08) line = [...line].slice(0, -1).join('')
+    else if (bytes[0] === 0x0D || bytes[0] === 0x03) line = ''
+    else if (bytes[0] >= 0x20) line = [...(line + text)].slice(0, COLS - 3).join('')
+    pump()
+  }
+
+  let rx = Buffer.alloc(0)
+  socket.on('data', (chunk) => {
+    let frames
+    ;[frames, rx] = wsParse(Buffer.concat([rx, chunk]))
+    for (const { opcode, payload } of frames) {
+      if (opcode === 8) { socket.end(wsFrame(8, Buffer.alloc(0))); return }
+      if (opcode === 9) { socket.write(wsFrame(10, payload)); continue }
+      if (opcode !== 2 || payload.length === 0) continue
+      const kind = String.fromCharCode(payload[0])
+      if ((kind === 'A' || kind === 'R') && payload.length === 5) onAck(kind, payload.readUInt32LE(1))
+      else if (kind === 'K') onKey(payload.subarray(1))
+      else check(false, `unexpected client message '${kind}' (${payload.length} bytes)`)
+    }
+  })
+  socket.on('close', () => console.log('client disconnected'))
+
+  // Step 1
+  seq++
+  expect.push([seq, 'A'], [seq + 1, 'R'], [seq + 2, 'A'])
+  send(fullState(seq, line))
+}
+
+const server = createServer((req, res) => {
+  res.writeHead(426, { 'Content-Type': 'text/plain' })
+  res.end('WebSocket only\n')
+})
+
+server.on('upgrade', (req, socket) => {
+  const key = req.headers['sec-websocket-key']
+  if (!key) { socket.destroy(); return }
+  const accept = createHash('sha1').update(key + '258EAFA5-E914-47DA-95CA-C5AB0DC85B11').digest('base64')
+  socket.write('HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n' +
+               `Sec-WebSocket-Accept: ${accept}\r\n\r\n`)
+  console.log(`client connected (${req.url})`)
+  session(socket)
+})
+
+server.listen(PORT, () => console.log(`cotty ws stand-in on ws://localhost:${PORT}/term`))